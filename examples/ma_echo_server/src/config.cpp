@@ -35,6 +35,8 @@ const char* socket_recv_buffer_size_option_name = "sock-recv-buffer";
 const char* socket_send_buffer_size_option_name = "sock-send-buffer";
 const char* socket_no_delay_option_name         = "sock-no-delay";
 const char* demux_option_name                   = "demux-per-work-thread";
+const char* zero_copy_option_name               = "zero-copy";
+const char* lazy_buffer_option_name             = "lazy-buffer";
 const std::string default_system_value          = "system default";
 
 template <typename Value>
@@ -210,6 +212,16 @@ boost::program_options::options_description build_cmd_options_description(
       boost::program_options::value<bool>()->default_value(
           default_ios_per_work_thread),
       "set demultiplexer-per-work-thread mode on"
+    )
+    (
+      zero_copy_option_name,
+      boost::program_options::value<bool>()->default_value(false),
+      "set zero-copy (splice) echo mode on (Linux only)"
+    )
+    (
+      lazy_buffer_option_name,
+      boost::program_options::value<bool>()->default_value(false),
+      "set session's buffer to be attached only when there is data to echo"
     );
 
   return description;
@@ -299,6 +311,12 @@ void print_config(std::ostream& stream, std::size_t cpu_count,
          << std::endl
          << "Session's socket Nagle algorithm is            : "
          << to_string(session_config.no_delay, default_system_value)
+         << std::endl
+         << "Session's zero-copy (splice) echo mode         : "
+         << to_string(session_config.zero_copy)
+         << std::endl
+         << "Session's lazy buffer attachment               : "
+         << to_string(session_config.lazy_buffer)
          << std::endl;
 }
 
@@ -374,9 +392,16 @@ ma::echo::server::session_config build_session_config(
   boost::optional<int> socket_send_buffer_size = read_socket_buffer_size(
       options_values, socket_send_buffer_size_option_name);
 
+  bool zero_copy = options_values[zero_copy_option_name].as<bool>();
+#if !defined(MA_HAS_LINUX_SPLICE)
+  validate_option<bool>(zero_copy_option_name, zero_copy, false, false);
+#endif
+
+  bool lazy_buffer = options_values[lazy_buffer_option_name].as<bool>();
+
   return session_config(buffer_size, max_transfer_size,
       socket_recv_buffer_size, socket_send_buffer_size, no_delay,
-      inactivity_timeout);
+      inactivity_timeout, zero_copy, lazy_buffer);
 }
 
 ma::echo::server::session_manager_config build_session_manager_config(
@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2010-2015 Marat Abrarov (abrarov@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef MA_ECHO_SERVER_PIPE_BUFFER_HPP
+#define MA_ECHO_SERVER_PIPE_BUFFER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <cstddef>
+#include <boost/noncopyable.hpp>
+#include <boost/system/error_code.hpp>
+#include <ma/config.hpp>
+
+namespace ma {
+namespace echo {
+namespace server {
+
+/// Kernel pipe used as the intermediate buffer of zero-copy echo.
+/**
+ * Data is moved socket -> pipe -> socket by the means of splice(2) so it is
+ * never copied to user space. pipe_buffer tracks the number of bytes stored
+ * in the pipe, so it can be used like cyclic_buffer by the session state
+ * machine.
+ *
+ * If MA_HAS_LINUX_SPLICE is not defined then open() always fails with
+ * boost::asio::error::operation_not_supported.
+ */
+class pipe_buffer : private boost::noncopyable
+{
+public:
+  typedef int native_handle_type;
+
+  explicit pipe_buffer(std::size_t capacity);
+  ~pipe_buffer();
+
+  /// Creates the pipe if it isn't created yet.
+  boost::system::error_code open();
+  void close();
+  bool is_open() const;
+
+  /// Discards all stored data.
+  boost::system::error_code reset();
+
+  std::size_t size() const;
+  bool empty() const;
+  /// Returns true if more data can be spliced into the pipe.
+  bool has_space() const;
+
+  /// Moves up to max_size bytes from the given (non-blocking) descriptor into
+  /// the pipe. Returns zero with no error if end of stream is reached and
+  /// boost::asio::error::would_block if there is no data ready.
+  std::size_t splice_from(native_handle_type handle, std::size_t max_size,
+      boost::system::error_code& error);
+
+  /// Moves up to max_size stored bytes from the pipe into the given
+  /// (non-blocking) descriptor.
+  std::size_t splice_to(native_handle_type handle, std::size_t max_size,
+      boost::system::error_code& error);
+
+private:
+  const std::size_t  requested_capacity_;
+  std::size_t        capacity_;
+  std::size_t        size_;
+  bool               full_;
+  native_handle_type read_handle_;
+  native_handle_type write_handle_;
+}; // class pipe_buffer
+
+inline bool pipe_buffer::is_open() const
+{
+  return -1 != read_handle_;
+}
+
+inline std::size_t pipe_buffer::size() const
+{
+  return size_;
+}
+
+inline bool pipe_buffer::empty() const
+{
+  return 0 == size_;
+}
+
+inline bool pipe_buffer::has_space() const
+{
+  return !full_ && (size_ < capacity_);
+}
+
+} // namespace server
+} // namespace echo
+} // namespace ma
+
+#endif // MA_ECHO_SERVER_PIPE_BUFFER_HPP
@@ -25,6 +25,8 @@
 #include <ma/bind_handler.hpp>
 #include <ma/context_alloc_handler.hpp>
 #include <ma/echo/server/session_config.hpp>
+#include <ma/echo/server/pipe_buffer.hpp>
+#include <ma/echo/server/session_buffer_pool.hpp>
 #include <ma/echo/server/session_fwd.hpp>
 #include <ma/strand.hpp>
 #include <ma/steady_deadline_timer.hpp>
@@ -105,6 +107,7 @@ private:
   typedef steady_deadline_timer          deadline_timer;
   typedef deadline_timer::duration_type  duration_type;
   typedef boost::optional<duration_type> optional_duration;
+  typedef session_buffer_pool::buffer_ptr buffer_ptr;
 
   template <typename Handler>
   void start_extern_start(Handler&);
@@ -118,6 +121,8 @@ private:
   void handle_read(const boost::system::error_code&, std::size_t);
   void handle_write(const boost::system::error_code&, std::size_t);
   void handle_timer(const boost::system::error_code&);
+  void handle_read_ready(const boost::system::error_code&, std::size_t);
+  void handle_write_ready(const boost::system::error_code&, std::size_t);
 
   boost::system::error_code do_start_extern_start();
   optional_error_code do_start_extern_stop();
@@ -150,8 +155,12 @@ private:
 
   void start_socket_read(const cyclic_buffer::mutable_buffers_type&);
   void start_socket_write(const cyclic_buffer::const_buffers_type&);
+  void start_socket_read_wait();
+  void start_socket_write_wait();
   void start_timer_wait();
   boost::system::error_code cancel_timer_wait();
+  void release_drained_buffer();
+  void release_buffer();
   boost::system::error_code shutdown_socket();
   boost::system::error_code close_socket();
   boost::system::error_code apply_socket_options();
@@ -164,6 +173,9 @@ private:
   const session_config::optional_int  socket_send_buffer_size_;
   const session_config::tribool       no_delay_;
   const optional_duration             inactivity_timeout_;
+  const bool                          zero_copy_;
+  const bool                          lazy_buffer_;
+  const std::size_t                   buffer_size_;
 
   extern_state::value_t extern_state_;
   intern_state::value_t intern_state_;
@@ -178,7 +190,9 @@ private:
   ma::strand                strand_;
   protocol_type::socket     socket_;
   deadline_timer            timer_;
-  cyclic_buffer             buffer_;
+  session_buffer_pool&      buffer_pool_;
+  buffer_ptr                buffer_;
+  pipe_buffer               pipe_;
   boost::system::error_code extern_wait_error_;
 
   handler_storage<boost::system::error_code> extern_wait_handler_;
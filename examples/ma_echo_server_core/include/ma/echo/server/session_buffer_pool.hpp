@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2010-2015 Marat Abrarov (abrarov@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef MA_ECHO_SERVER_SESSION_BUFFER_POOL_HPP
+#define MA_ECHO_SERVER_SESSION_BUFFER_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <cstddef>
+#include <vector>
+#include <boost/asio.hpp>
+#include <ma/config.hpp>
+#include <ma/cyclic_buffer.hpp>
+#include <ma/detail/service_base.hpp>
+#include <ma/detail/memory.hpp>
+#include <ma/detail/thread.hpp>
+
+namespace ma {
+namespace echo {
+namespace server {
+
+/// Pool of session buffers shared by all sessions of the same io_service.
+/**
+ * Is used by sessions which attach buffer only when socket has data to read
+ * (see session_config::lazy_buffer). Buffers are reused in LIFO order to keep
+ * the hot ones in cache. Pool never frees cached buffers until io_service
+ * destruction so its size is limited by the peak number of simultaneously
+ * busy sessions.
+ */
+class session_buffer_pool
+  : public detail::service_base<session_buffer_pool>
+{
+public:
+  typedef detail::shared_ptr<cyclic_buffer> buffer_ptr;
+
+  explicit session_buffer_pool(boost::asio::io_service& io_service);
+  ~session_buffer_pool();
+
+  /// Returns buffer with empty filled sequence.
+  buffer_ptr take(std::size_t size);
+
+  /// Returns buffer to the pool. The buffer content is dropped.
+  void give(const buffer_ptr& buffer);
+
+protected:
+  virtual void shutdown_service();
+
+private:
+  typedef detail::mutex                  mutex_type;
+  typedef detail::lock_guard<mutex_type> lock_guard_type;
+  typedef std::vector<buffer_ptr>        buffer_vector;
+
+  mutex_type    mutex_;
+  buffer_vector buffers_;
+}; // class session_buffer_pool
+
+} // namespace server
+} // namespace echo
+} // namespace ma
+
+#endif // MA_ECHO_SERVER_SESSION_BUFFER_POOL_HPP
@@ -37,7 +37,9 @@ public:
       const optional_int& socket_recv_buffer_size = boost::none,
       const optional_int& socket_send_buffer_size = boost::none,
       const tribool& no_delay = boost::logic::indeterminate,
-      const optional_time_duration& inactivity_timeout = boost::none);
+      const optional_time_duration& inactivity_timeout = boost::none,
+      bool zero_copy = false,
+      bool lazy_buffer = false);
 
   tribool       no_delay;
   optional_int  socket_recv_buffer_size;
@@ -45,6 +47,13 @@ public:
   std::size_t   buffer_size;
   std::size_t   max_transfer_size;
   optional_time_duration inactivity_timeout;
+  /// Turns on echo by the means of splice(2) (socket -> pipe -> socket).
+  /// Requires MA_HAS_LINUX_SPLICE otherwise session fails to start.
+  bool          zero_copy;
+  /// Turns on attachment of buffer only when socket has data to read and
+  /// detachment as soon as all read data is written, so idle session holds
+  /// no buffer. Buffers are shared by the sessions of the same io_service.
+  bool          lazy_buffer;
 }; // struct session_config
 
 inline session_config::session_config(
@@ -53,13 +62,17 @@ inline session_config::session_config(
     const optional_int& the_socket_recv_buffer_size,
     const optional_int& the_socket_send_buffer_size,
     const tribool& the_no_delay,
-    const optional_time_duration& the_inactivity_timeout)
+    const optional_time_duration& the_inactivity_timeout,
+    bool the_zero_copy,
+    bool the_lazy_buffer)
   : no_delay(the_no_delay)
   , socket_recv_buffer_size(the_socket_recv_buffer_size)
   , socket_send_buffer_size(the_socket_send_buffer_size)
   , buffer_size(the_buffer_size)
   , max_transfer_size(the_max_transfer_size)
   , inactivity_timeout(the_inactivity_timeout)
+  , zero_copy(the_zero_copy)
+  , lazy_buffer(the_lazy_buffer)
 {
   BOOST_ASSERT_MSG(the_buffer_size > 0, "buffer_size must be > 0");
 
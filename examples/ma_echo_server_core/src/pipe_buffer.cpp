@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2010-2015 Marat Abrarov (abrarov@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <ma/config.hpp>
+
+#if defined(MA_HAS_LINUX_SPLICE)
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // defined(MA_HAS_LINUX_SPLICE)
+
+#include <algorithm>
+#include <boost/asio.hpp>
+#include <boost/assert.hpp>
+#include <ma/echo/server/pipe_buffer.hpp>
+
+namespace ma {
+namespace echo {
+namespace server {
+
+#if defined(MA_HAS_LINUX_SPLICE)
+
+namespace {
+
+boost::system::error_code last_error()
+{
+  return boost::system::error_code(errno,
+      boost::asio::error::get_system_category());
+}
+
+const unsigned int splice_flags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+
+} // anonymous namespace
+
+#endif // defined(MA_HAS_LINUX_SPLICE)
+
+pipe_buffer::pipe_buffer(std::size_t capacity)
+  : requested_capacity_(capacity)
+  , capacity_(capacity)
+  , size_(0)
+  , full_(false)
+  , read_handle_(-1)
+  , write_handle_(-1)
+{
+  BOOST_ASSERT_MSG(capacity > 0, "capacity must be > 0");
+}
+
+pipe_buffer::~pipe_buffer()
+{
+  close();
+}
+
+#if defined(MA_HAS_LINUX_SPLICE)
+
+boost::system::error_code pipe_buffer::open()
+{
+  if (is_open())
+  {
+    return boost::system::error_code();
+  }
+
+  native_handle_type handles[2];
+  if (-1 == ::pipe2(handles, O_NONBLOCK | O_CLOEXEC))
+  {
+    return last_error();
+  }
+  read_handle_  = handles[0];
+  write_handle_ = handles[1];
+  size_ = 0;
+  full_ = false;
+
+  // Pipe capacity is only a hint: the kernel rounds it up to the power of 2
+  // pages and unprivileged processes are limited by fs.pipe-max-size
+  ::fcntl(write_handle_, F_SETPIPE_SZ, static_cast<int>(requested_capacity_));
+  int actual_capacity = ::fcntl(write_handle_, F_GETPIPE_SZ);
+  if (actual_capacity > 0)
+  {
+    capacity_ = static_cast<std::size_t>(actual_capacity);
+  }
+  return boost::system::error_code();
+}
+
+void pipe_buffer::close()
+{
+  if (is_open())
+  {
+    ::close(read_handle_);
+    ::close(write_handle_);
+    read_handle_  = -1;
+    write_handle_ = -1;
+  }
+  size_ = 0;
+  full_ = false;
+}
+
+boost::system::error_code pipe_buffer::reset()
+{
+  if (size_)
+  {
+    // There is no cheap way to discard pipe's data so recreate the pipe.
+    // It happens only when session shuts down with unsent data.
+    close();
+    return open();
+  }
+  full_ = false;
+  return boost::system::error_code();
+}
+
+std::size_t pipe_buffer::splice_from(native_handle_type handle,
+    std::size_t max_size, boost::system::error_code& error)
+{
+  BOOST_ASSERT_MSG(is_open(), "Pipe must be open");
+  BOOST_ASSERT_MSG(has_space(), "Pipe must have space");
+
+  std::size_t transfer_size = (std::min)(max_size, capacity_ - size_);
+  ssize_t result = ::splice(handle, 0, write_handle_, 0, transfer_size,
+      splice_flags);
+  if (result < 0)
+  {
+    error = last_error();
+    // EAGAIN is ambiguous: socket can be not ready or pipe can run out of
+    // its slots (every splice can take a separate page). Readiness was just
+    // reported for the socket so consider non-empty pipe as full until
+    // the next splice_to.
+    if ((boost::asio::error::would_block == error) && size_)
+    {
+      full_ = true;
+    }
+    return 0;
+  }
+  error = boost::system::error_code();
+  size_ += static_cast<std::size_t>(result);
+  return static_cast<std::size_t>(result);
+}
+
+std::size_t pipe_buffer::splice_to(native_handle_type handle,
+    std::size_t max_size, boost::system::error_code& error)
+{
+  BOOST_ASSERT_MSG(is_open(), "Pipe must be open");
+  BOOST_ASSERT_MSG(!empty(), "Pipe must have data");
+
+  std::size_t transfer_size = (std::min)(max_size, size_);
+  ssize_t result = ::splice(read_handle_, 0, handle, 0, transfer_size,
+      splice_flags);
+  if (result < 0)
+  {
+    error = last_error();
+    return 0;
+  }
+  error = boost::system::error_code();
+  size_ -= static_cast<std::size_t>(result);
+  full_ = false;
+  return static_cast<std::size_t>(result);
+}
+
+#else // defined(MA_HAS_LINUX_SPLICE)
+
+boost::system::error_code pipe_buffer::open()
+{
+  return boost::asio::error::operation_not_supported;
+}
+
+void pipe_buffer::close()
+{
+  size_ = 0;
+  full_ = false;
+}
+
+boost::system::error_code pipe_buffer::reset()
+{
+  size_ = 0;
+  full_ = false;
+  return boost::system::error_code();
+}
+
+std::size_t pipe_buffer::splice_from(native_handle_type /*handle*/,
+    std::size_t /*max_size*/, boost::system::error_code& error)
+{
+  error = boost::asio::error::operation_not_supported;
+  return 0;
+}
+
+std::size_t pipe_buffer::splice_to(native_handle_type /*handle*/,
+    std::size_t /*max_size*/, boost::system::error_code& error)
+{
+  error = boost::asio::error::operation_not_supported;
+  return 0;
+}
+
+#endif // defined(MA_HAS_LINUX_SPLICE)
+
+} // namespace server
+} // namespace echo
+} // namespace ma
@@ -131,6 +131,9 @@ session::session(boost::asio::io_service& io_service,
   , socket_send_buffer_size_(config.socket_send_buffer_size)
   , no_delay_(config.no_delay)
   , inactivity_timeout_(to_optional_duration(config.inactivity_timeout))
+  , zero_copy_(config.zero_copy)
+  , lazy_buffer_(config.lazy_buffer)
+  , buffer_size_(config.buffer_size)
   , extern_state_(extern_state::ready)
   , intern_state_(intern_state::work)
   , read_state_(read_state::wait)
@@ -143,7 +146,10 @@ session::session(boost::asio::io_service& io_service,
   , strand_(io_service)
   , socket_(io_service)
   , timer_(io_service)
-  , buffer_(config.buffer_size)
+  , buffer_pool_(boost::asio::use_service<session_buffer_pool>(io_service))
+  , buffer_(config.zero_copy || config.lazy_buffer ? buffer_ptr()
+        : detail::make_shared<cyclic_buffer>(config.buffer_size))
+  , pipe_(config.buffer_size)
   , extern_wait_handler_(io_service)
   , extern_stop_handler_(io_service)
 {
@@ -167,7 +173,16 @@ void session::reset()
   close_socket();
 
   // Post condition: filled sequence is empty, unfilled sequence is empty.
-  buffer_.reset();
+  if (lazy_buffer_)
+  {
+    release_buffer();
+  }
+  else if (buffer_)
+  {
+    buffer_->reset();
+  }
+  // Pipe is kept open between sessions, errors will be detected at start.
+  pipe_.reset();
   extern_wait_error_.clear();
 }
 
@@ -179,8 +194,14 @@ boost::system::error_code session::do_start_extern_start()
     return server::error::invalid_state;
   }
 
-  // Set up configured socket options
-  if (boost::system::error_code error = apply_socket_options())
+  // Set up configured socket options and zero-copy pipe
+  boost::system::error_code error = apply_socket_options();
+  if (!error && zero_copy_)
+  {
+    error = pipe_.open();
+  }
+
+  if (error)
   {
     close_socket();
     // Switch states as SM suppose...
@@ -350,6 +371,88 @@ void session::handle_timer(const boost::system::error_code& error)
   }
 }
 
+void session::handle_read_ready(const boost::system::error_code& error,
+    std::size_t /*bytes_transferred*/)
+{
+  BOOST_ASSERT_MSG(read_state::in_progress == read_state_,
+      "Invalid read state");
+
+  // Socket is already closed at stop so there is nothing to splice
+  if (error || (intern_state::stop == intern_state_))
+  {
+    handle_read(error, 0);
+    return;
+  }
+
+  boost::system::error_code read_error;
+  std::size_t bytes_transferred;
+  if (zero_copy_)
+  {
+    bytes_transferred = pipe_.splice_from(socket_.native_handle(),
+        max_transfer_size_, read_error);
+    if (!read_error && !bytes_transferred)
+    {
+      read_error = boost::asio::error::eof;
+    }
+  }
+  else
+  {
+    // Socket has data to read so it's time to attach buffer
+    if (!buffer_)
+    {
+      buffer_ = buffer_pool_.take(buffer_size_);
+    }
+    bytes_transferred = socket_.read_some(
+        buffer_->prepared(max_transfer_size_), read_error);
+  }
+
+  if (boost::asio::error::would_block == read_error)
+  {
+    if (!zero_copy_ || pipe_.has_space())
+    {
+      // Spurious readiness - wait for the next one
+      --pending_operations_;
+      read_state_ = read_state::wait;
+      release_drained_buffer();
+      start_socket_read_wait();
+      return;
+    }
+    // Pipe is full - complete read without data and wait for write
+    read_error = boost::system::error_code();
+  }
+
+  handle_read(read_error, bytes_transferred);
+}
+
+void session::handle_write_ready(const boost::system::error_code& error,
+    std::size_t /*bytes_transferred*/)
+{
+  BOOST_ASSERT_MSG(write_state::in_progress == write_state_,
+      "Invalid write state");
+
+  // Socket is already closed at stop so there is nothing to splice
+  if (error || (intern_state::stop == intern_state_))
+  {
+    handle_write(error, 0);
+    return;
+  }
+
+  boost::system::error_code splice_error;
+  std::size_t bytes_transferred = pipe_.splice_to(socket_.native_handle(),
+      max_transfer_size_, splice_error);
+
+  if (boost::asio::error::would_block == splice_error)
+  {
+    // Spurious readiness - wait for the next one
+    --pending_operations_;
+    write_state_ = write_state::wait;
+    start_socket_write_wait();
+    return;
+  }
+
+  handle_write(splice_error, bytes_transferred);
+}
+
 void session::handle_read_at_work(const boost::system::error_code& error,
     std::size_t bytes_transferred)
 {
@@ -381,8 +484,11 @@ void session::handle_read_at_work(const boost::system::error_code& error,
     return;
   }
 
-  // Handle read data
-  buffer_.consume(bytes_transferred);
+  // Handle read data (spliced data is already accounted by pipe_)
+  if (!zero_copy_)
+  {
+    buffer_->consume(bytes_transferred);
+  }
 
   // If EOF is recieved then read activity (SM) is stopped
   if (boost::asio::error::eof == error)
@@ -423,8 +529,11 @@ void session::handle_read_at_shutdown(const boost::system::error_code& error,
     return;
   }
 
-  // Handle read data
-  buffer_.consume(bytes_transferred);
+  // Handle read data (spliced data is already accounted by pipe_)
+  if (!zero_copy_)
+  {
+    buffer_->consume(bytes_transferred);
+  }
 
   // If EOF is recieved then read activity is stopped
   if (boost::asio::error::eof == error)
@@ -477,8 +586,11 @@ void session::handle_write_at_work(const boost::system::error_code& error,
     return;
   }
 
-  // Handle written data
-  buffer_.commit(bytes_transferred);
+  // Handle written data (spliced data is already accounted by pipe_)
+  if (!zero_copy_)
+  {
+    buffer_->commit(bytes_transferred);
+  }
   continue_work();
 }
 
@@ -510,8 +622,11 @@ void session::handle_write_at_shutdown(const boost::system::error_code& error,
     return;
   }
 
-  // Handle written data
-  buffer_.commit(bytes_transferred);
+  // Handle written data (spliced data is already accounted by pipe_)
+  if (!zero_copy_)
+  {
+    buffer_->commit(bytes_transferred);
+  }
   continue_shutdown(true);
 }
 
@@ -588,25 +703,58 @@ void session::continue_work()
   BOOST_ASSERT_MSG(timer_state::stopped != timer_state_,
       "Invalid timer state");
 
+  // Don't hold buffer while waiting for the data
+  if (lazy_buffer_)
+  {
+    release_drained_buffer();
+  }
+
   if (read_state::wait == read_state_)
   {
-    cyclic_buffer::mutable_buffers_type read_buffers(
-        buffer_.prepared(max_transfer_size_));
-    if (!read_buffers.empty())
+    if (zero_copy_)
     {
-      // We have enough resources to begin socket read
-      start_socket_read(read_buffers);
+      if (pipe_.has_space())
+      {
+        start_socket_read_wait();
+      }
+    }
+    else if (lazy_buffer_)
+    {
+      if (!buffer_ || !buffer_->prepared(max_transfer_size_).empty())
+      {
+        start_socket_read_wait();
+      }
+    }
+    else
+    {
+      cyclic_buffer::mutable_buffers_type read_buffers(
+          buffer_->prepared(max_transfer_size_));
+      if (!read_buffers.empty())
+      {
+        // We have enough resources to begin socket read
+        start_socket_read(read_buffers);
+      }
     }
   }
 
   if (write_state::wait == write_state_)
   {
-    cyclic_buffer::const_buffers_type write_buffers(
-        buffer_.data(max_transfer_size_));
-    if (!write_buffers.empty())
+    if (zero_copy_)
     {
-      // We have enough resources to begin socket write
-      start_socket_write(write_buffers);
+      if (!pipe_.empty())
+      {
+        start_socket_write_wait();
+      }
+    }
+    else if (buffer_)
+    {
+      cyclic_buffer::const_buffers_type write_buffers(
+          buffer_->data(max_transfer_size_));
+      if (!write_buffers.empty())
+      {
+        // We have enough resources to begin socket write
+        start_socket_write(write_buffers);
+      }
     }
   }
 
@@ -696,17 +844,51 @@ void session::continue_shutdown_at_read_wait(bool need_timer_restart)
   if (write_state::stopped == write_state_)
   {
     // We won't make any income data handling more
-    buffer_.reset();
-    cyclic_buffer::mutable_buffers_type read_buffers(buffer_.prepared());
-    BOOST_ASSERT_MSG(!read_buffers.empty(), "buffer_ must be unfilled");
+    if (zero_copy_)
+    {
+      if (boost::system::error_code error = pipe_.reset())
+      {
+        // Fatal error
+        start_stop(error);
+        return;
+      }
+      start_socket_read_wait();
+    }
+    else if (lazy_buffer_)
+    {
+      release_buffer();
+      start_socket_read_wait();
+    }
+    else
+    {
+      buffer_->reset();
+      cyclic_buffer::mutable_buffers_type read_buffers(buffer_->prepared());
+      BOOST_ASSERT_MSG(!read_buffers.empty(), "buffer_ must be unfilled");
 
-    // We have enough resources to begin socket read
-    start_socket_read(read_buffers);
+      // We have enough resources to begin socket read
+      start_socket_read(read_buffers);
+    }
+  }
+  else if (zero_copy_)
+  {
+    // write_state::in_progress == write_state_
+    if (pipe_.has_space())
+    {
+      start_socket_read_wait();
+    }
+  }
+  else if (lazy_buffer_)
+  {
+    // write_state::in_progress == write_state_ so buffer is attached
+    if (!buffer_->prepared().empty())
+    {
+      start_socket_read_wait();
+    }
   }
   else
   {
     // write_state::in_progress == write_state_
-    cyclic_buffer::mutable_buffers_type read_buffers(buffer_.prepared());
+    cyclic_buffer::mutable_buffers_type read_buffers(buffer_->prepared());
     if (!read_buffers.empty())
     {
       // We have enough resources to begin socket read
@@ -759,9 +941,16 @@ void session::continue_shutdown_at_read_stopped(bool need_timer_restart)
   if (write_state::wait == write_state_)
   {
     // Write last read data
-    cyclic_buffer::const_buffers_type write_buffers(
-        buffer_.data(max_transfer_size_));
-    if (!write_buffers.empty())
+    cyclic_buffer::const_buffers_type write_buffers;
+    if (buffer_)
+    {
+      write_buffers = buffer_->data(max_transfer_size_);
+    }
+    if (zero_copy_ && !pipe_.empty())
+    {
+      start_socket_write_wait();
+    }
+    else if (!write_buffers.empty())
     {
       // We have enough resources to begin socket write
       start_socket_write(write_buffers);
@@ -928,6 +1117,50 @@ void session::start_socket_write(
   write_state_ = write_state::in_progress;
 }
 
+void session::start_socket_read_wait()
+{
+  // Wait for socket readiness and splice data at handle_read_ready
+#if defined(MA_HAS_RVALUE_REFS) && defined(MA_BIND_HAS_NO_MOVE_CONSTRUCTOR)
+
+  socket_.async_read_some(boost::asio::null_buffers(), strand_.wrap(
+      make_custom_alloc_handler(read_allocator_, io_handler_binder(
+          &this_type::handle_read_ready, shared_from_this()))));
+
+#else
+
+  socket_.async_read_some(boost::asio::null_buffers(), strand_.wrap(
+      make_custom_alloc_handler(read_allocator_, detail::bind(
+          &this_type::handle_read_ready, shared_from_this(),
+          detail::placeholders::_1, detail::placeholders::_2))));
+
+#endif
+
+  ++pending_operations_;
+  read_state_ = read_state::in_progress;
+}
+
+void session::start_socket_write_wait()
+{
+  // Wait for socket readiness and splice data at handle_write_ready
+#if defined(MA_HAS_RVALUE_REFS) && defined(MA_BIND_HAS_NO_MOVE_CONSTRUCTOR)
+
+  socket_.async_write_some(boost::asio::null_buffers(), strand_.wrap(
+      make_custom_alloc_handler(write_allocator_, io_handler_binder(
+          &this_type::handle_write_ready, shared_from_this()))));
+
+#else
+
+  socket_.async_write_some(boost::asio::null_buffers(), strand_.wrap(
+      make_custom_alloc_handler(write_allocator_, detail::bind(
+          &this_type::handle_write_ready, shared_from_this(),
+          detail::placeholders::_1, detail::placeholders::_2))));
+
+#endif
+
+  ++pending_operations_;
+  write_state_ = write_state::in_progress;
+}
+
 void session::start_timer_wait()
 {
   BOOST_ASSERT_MSG(timer_state::ready == timer_state_,
@@ -967,6 +1200,25 @@ boost::system::error_code session::cancel_timer_wait()
   return error;
 }
 
+void session::release_drained_buffer()
+{
+  // Buffer can be released if all read data is written
+  if (buffer_ && (write_state::in_progress != write_state_)
+      && buffer_->data().empty())
+  {
+    release_buffer();
+  }
+}
+
+void session::release_buffer()
+{
+  if (buffer_)
+  {
+    buffer_pool_.give(buffer_);
+    buffer_.reset();
+  }
+}
+
 boost::system::error_code session::shutdown_socket()
 {
   boost::system::error_code error;
@@ -996,6 +1248,18 @@ boost::system::error_code session::apply_socket_options()
     }
   }
 
+  // Data is read (spliced) synchronously after readiness notification
+  // so socket has to be in non-blocking mode
+  if (zero_copy_ || lazy_buffer_)
+  {
+    boost::system::error_code error;
+    socket_.non_blocking(true, error);
+    if (error)
+    {
+      return error;
+    }
+  }
+
   // Apply all (really) configured socket options
   if (socket_recv_buffer_size_)
   {
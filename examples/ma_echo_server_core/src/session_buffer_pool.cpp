@@ -0,0 +1,59 @@
+//
+// Copyright (c) 2010-2015 Marat Abrarov (abrarov@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/assert.hpp>
+#include <ma/echo/server/session_buffer_pool.hpp>
+
+namespace ma {
+namespace echo {
+namespace server {
+
+session_buffer_pool::session_buffer_pool(boost::asio::io_service& io_service)
+  : detail::service_base<session_buffer_pool>(io_service)
+{
+}
+
+session_buffer_pool::~session_buffer_pool()
+{
+}
+
+session_buffer_pool::buffer_ptr session_buffer_pool::take(std::size_t size)
+{
+  {
+    lock_guard_type lock_guard(mutex_);
+    // Search from the top (the most recently used) buffer
+    for (buffer_vector::reverse_iterator i = buffers_.rbegin(),
+        end = buffers_.rend(); i != end; ++i)
+    {
+      if (size == (*i)->size())
+      {
+        buffer_ptr buffer = *i;
+        buffers_.erase(i.base() - 1);
+        return buffer;
+      }
+    }
+  }
+  return detail::make_shared<cyclic_buffer>(size);
+}
+
+void session_buffer_pool::give(const buffer_ptr& buffer)
+{
+  BOOST_ASSERT_MSG(buffer, "buffer must be not null");
+  buffer->reset();
+  lock_guard_type lock_guard(mutex_);
+  buffers_.push_back(buffer);
+}
+
+void session_buffer_pool::shutdown_service()
+{
+  lock_guard_type lock_guard(mutex_);
+  buffer_vector().swap(buffers_);
+}
+
+} // namespace server
+} // namespace echo
+} // namespace ma
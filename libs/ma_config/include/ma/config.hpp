@@ -200,6 +200,14 @@
 #undef  MA_HAS_WINDOWS_CONSOLE_SIGNAL
 #endif
 
+// Check Linux splice(2) availability
+#if defined(__linux__)
+/// Turns on usage of splice(2) for zero-copy transfers between sockets.
+#define MA_HAS_LINUX_SPLICE
+#else
+#undef  MA_HAS_LINUX_SPLICE
+#endif
+
 #if defined(BOOST_MSVC) && (BOOST_MSVC >= 1500)
 
 #if BOOST_MSVC < 1900